@@ -39,6 +39,10 @@ echo [*] Building WindowController.exe...
 cl /EHsc /O2 /I.\include /Fe:bin\WindowController.exe src\window_controller.cpp src\process_utils.cpp user32.lib psapi.lib /link /MANIFESTUAC:"level='requireAdministrator'"
 if %ERRORLEVEL% NEQ 0 goto :error
 
+echo [*] Building StringScanner.exe...
+cl /EHsc /O2 /I.\include /Fe:bin\StringScanner.exe src\string_scanner.cpp src\process_utils.cpp psapi.lib /link /MANIFESTUAC:"level='requireAdministrator'"
+if %ERRORLEVEL% NEQ 0 goto :error
+
 REM Clean up intermediate files
 del *.obj 2>nul
 
@@ -54,6 +58,10 @@ echo [*] Building WindowController.exe...
 g++ -O2 -o bin\WindowController.exe src\window_controller.cpp src\process_utils.cpp -I./include -luser32 -lpsapi -static
 if %ERRORLEVEL% NEQ 0 goto :error
 
+echo [*] Building StringScanner.exe...
+g++ -O2 -o bin\StringScanner.exe src\string_scanner.cpp src\process_utils.cpp -I./include -lpsapi -static -pthread
+if %ERRORLEVEL% NEQ 0 goto :error
+
 goto :success
 
 :error
@@ -71,6 +79,7 @@ echo.
 echo Executables are in: bin\
 echo - ProcessModifier.exe
 echo - WindowController.exe
+echo - StringScanner.exe
 echo.
 echo Run as Administrator to use the tools.
 echo.
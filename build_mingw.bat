@@ -53,6 +53,7 @@ echo.
 echo Executables are in: build\bin\
 echo - ProcessModifier.exe
 echo - WindowController.exe
+echo - StringScanner.exe
 echo.
 echo Run as Administrator to use the tools.
 echo.
@@ -0,0 +1,80 @@
+#include "process_utils.h"
+#include "remote_struct.h"
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace ProcessUtils;
+
+// Mirror of the node layout being walked
+struct Node {
+    RemotePtr<Node> next;
+    int value;
+    char payload[48];
+};
+
+using NodeNext = REMOTE_FIELD(Node, next);
+using NodeValue = REMOTE_FIELD(Node, value);
+using NodeView = RemoteLayout<NodeNext, NodeValue>;
+
+const size_t kListCount = 3;
+const size_t kListLength = 5;
+
+// Build kListCount lists of kListLength nodes, each node `stride` bytes after the previous one
+std::vector<RemotePtr<Node>> BuildLists(std::vector<BYTE>& arena, size_t stride) {
+    arena.assign(kListCount * kListLength * stride, 0);
+    std::vector<RemotePtr<Node>> heads;
+
+    for (size_t list = 0; list < kListCount; list++) {
+        for (size_t depth = 0; depth < kListLength; depth++) {
+            size_t index = depth * kListCount + list;
+            Node* node = reinterpret_cast<Node*>(&arena[index * stride]);
+            node->value = static_cast<int>(list * 100 + depth);
+            if (depth + 1 < kListLength) {
+                node->next = RemotePtr<Node>(static_cast<LPCVOID>(&arena[(index + kListCount) * stride]));
+            }
+        }
+        heads.push_back(RemotePtr<Node>(static_cast<LPCVOID>(&arena[list * stride])));
+    }
+
+    return heads;
+}
+
+void Walk(HANDLE hProcess, const char* label, size_t stride, SIZE_T maxGap = 256) {
+    std::vector<BYTE> arena;
+    std::vector<RemotePtr<Node>> heads = BuildLists(arena, stride);
+
+    long long sum = 0;
+    RemoteWalkResult result = WalkRemoteLists<NodeView, NodeNext>(
+        hProcess, heads, [&](size_t, const RemoteView<NodeView>& node) { sum += node.Get<NodeValue>(); },
+        kListLength, maxGap);
+
+    std::stringstream ss;
+    ss << label << ": visited " << result.visited << " nodes, " << result.fetches << " fetches, "
+       << result.reads << " reads, value sum " << sum;
+
+    if (result.Complete()) {
+        PrintSuccess(ss.str());
+    } else {
+        PrintWarning(ss.str() + " (some lists were truncated)");
+    }
+}
+
+int main() {
+    EnableConsoleColors(true);
+
+    std::cout << "\n";
+    PrintInfo("Remote Struct Example");
+    PrintInfo("Walks linked lists in this process through RemoteBatch");
+    std::cout << "\n";
+
+    // Reading our own process keeps the example self-contained
+    HANDLE hProcess = GetCurrentProcess();
+
+    Walk(hProcess, "Adjacent nodes", sizeof(Node));
+    Walk(hProcess, "Nodes a page apart", 4096);
+    Walk(hProcess, "Nodes a page apart, 4 KB gap", 4096, 4096);
+
+    std::cout << "\n";
+    return 0;
+}
@@ -3,9 +3,20 @@
 
 #include <windows.h>
 #include <string>
+#include <vector>
 
 namespace ProcessUtils {
 
+/**
+ * @brief Committed memory region in a remote process
+ */
+struct MemoryRegion {
+    ULONG_PTR baseAddress;  // Start of the region
+    SIZE_T size;            // Size in bytes
+    DWORD protect;          // PAGE_* protection flags
+    DWORD type;             // MEM_IMAGE, MEM_MAPPED or MEM_PRIVATE
+};
+
 /**
  * @brief Find process ID by executable name
  * @param processName Name of the executable (e.g., "notepad.exe")
@@ -57,6 +68,13 @@ bool ReadProcessMemorySafe(HANDLE hProcess, LPCVOID address, LPVOID buffer, SIZE
  */
 bool WriteProcessMemorySafe(HANDLE hProcess, LPVOID address, LPCVOID buffer, SIZE_T size);
 
+/**
+ * @brief Enumerate all committed, readable regions of a remote process
+ * @param hProcess Handle with PROCESS_QUERY_INFORMATION access
+ * @return Regions in ascending address order (empty on failure)
+ */
+std::vector<MemoryRegion> GetReadableRegions(HANDLE hProcess);
+
 /**
  * @brief Print detailed error message
  * @param context Error context description
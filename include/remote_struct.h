@@ -0,0 +1,419 @@
+#ifndef REMOTE_STRUCT_H
+#define REMOTE_STRUCT_H
+
+#include <windows.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ProcessUtils {
+
+/**
+ * @brief Typed address of a T living in a remote process
+ *
+ * Has the same size as a native pointer and is trivially copyable, so it can
+ * be used as a member of a local mirror struct to describe remote pointers.
+ */
+template <typename T>
+struct RemotePtr {
+    uintptr_t address = 0;
+
+    RemotePtr() = default;
+    explicit RemotePtr(uintptr_t addr) : address(addr) {}
+    explicit RemotePtr(LPCVOID addr) : address(reinterpret_cast<uintptr_t>(addr)) {}
+
+    bool IsNull() const { return address == 0; }
+    explicit operator bool() const { return address != 0; }
+    LPCVOID Get() const { return reinterpret_cast<LPCVOID>(address); }
+
+    bool operator==(const RemotePtr& other) const { return address == other.address; }
+    bool operator!=(const RemotePtr& other) const { return address != other.address; }
+};
+
+/**
+ * @brief Compile-time descriptor of one field of a remote struct
+ * @tparam Owner Local mirror struct describing the remote layout
+ * @tparam T Field type (must be trivially copyable)
+ * @tparam Offset Byte offset of the field inside Owner
+ */
+template <typename Owner, typename T, size_t Offset>
+struct RemoteField {
+    static_assert(std::is_trivially_copyable<T>::value, "Remote fields must be trivially copyable");
+
+    using owner_type = Owner;
+    using value_type = T;
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = sizeof(T);
+};
+
+/**
+ * @brief Declare a RemoteField for a member of a mirror struct
+ *
+ * Example: using NodeNext = REMOTE_FIELD(Node, next);
+ */
+#define REMOTE_FIELD(Owner, Member) \
+    ::ProcessUtils::RemoteField<Owner, decltype(Owner::Member), offsetof(Owner, Member)>
+
+namespace Detail {
+
+template <typename First, typename... Rest>
+constexpr size_t MinFieldOffset() {
+    if constexpr (sizeof...(Rest) == 0) {
+        return First::offset;
+    } else {
+        return (std::min)(First::offset, MinFieldOffset<Rest...>());
+    }
+}
+
+template <typename First, typename... Rest>
+constexpr size_t MaxFieldEnd() {
+    if constexpr (sizeof...(Rest) == 0) {
+        return First::offset + First::size;
+    } else {
+        return (std::max)(First::offset + First::size, MaxFieldEnd<Rest...>());
+    }
+}
+
+} // namespace Detail
+
+/**
+ * @brief Set of fields of one mirror struct that are read together
+ *
+ * Only the byte range [begin, end) covering the listed fields is fetched from
+ * the remote process, so a layout naming two fields of a large struct costs
+ * only the span between them.
+ */
+template <typename... Fields>
+struct RemoteLayout {
+    static_assert(sizeof...(Fields) > 0, "RemoteLayout needs at least one field");
+
+    using owner_type = typename std::tuple_element<0, std::tuple<Fields...>>::type::owner_type;
+    static_assert((std::is_same<typename Fields::owner_type, owner_type>::value && ...),
+                  "All fields of a RemoteLayout must belong to the same struct");
+
+    static constexpr size_t begin = Detail::MinFieldOffset<Fields...>();
+    static constexpr size_t end = Detail::MaxFieldEnd<Fields...>();
+    static constexpr size_t size = end - begin;
+
+    template <typename Field>
+    static constexpr bool Contains = (std::is_same<Field, Fields>::value || ...);
+};
+
+class RemoteBatch;
+
+/**
+ * @brief Deferred view of a remote struct gathered through a RemoteBatch
+ *
+ * Fields become readable once the owning batch has been fetched. The view
+ * stays valid for the lifetime of the batch, including across later fetches.
+ */
+template <typename Layout>
+class RemoteView {
+public:
+    using owner_type = typename Layout::owner_type;
+
+    RemoteView() = default;
+
+    /**
+     * @brief Address of the remote struct this view describes
+     */
+    RemotePtr<owner_type> Address() const { return address_; }
+
+    /**
+     * @brief Check whether the fields were read successfully
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Read a field from the fetched snapshot
+     * @return Field value, or a value-initialized T if the read failed
+     */
+    template <typename Field>
+    typename Field::value_type Get() const;
+
+private:
+    friend class RemoteBatch;
+
+    RemoteView(const RemoteBatch* batch, size_t request, RemotePtr<owner_type> address)
+        : batch_(batch), request_(request), address_(address) {}
+
+    const RemoteBatch* batch_ = nullptr;
+    size_t request_ = 0;
+    RemotePtr<owner_type> address_;
+};
+
+/**
+ * @brief Collects remote reads and issues them as coalesced batches
+ *
+ * Queue every struct needed at the current pointer depth with Gather(), then
+ * call Fetch() once. Requests are sorted by address and requests that overlap
+ * or lie within maxGap bytes of each other share a single ReadProcessMemory
+ * call; requests further apart still cost one call each. A layout always
+ * costs one read per struct, never one per field. Use ReadCount() to see how
+ * many calls a Fetch() actually issued.
+ *
+ * Views keep a pointer to their batch, so a batch cannot be copied or moved.
+ */
+class RemoteBatch {
+public:
+    /**
+     * @param hProcess Handle with PROCESS_VM_READ access
+     * @param maxGap Largest hole between two requests that is still read as one span
+     */
+    explicit RemoteBatch(HANDLE hProcess, SIZE_T maxGap = 256)
+        : hProcess_(hProcess), maxGap_(maxGap) {}
+
+    RemoteBatch(const RemoteBatch&) = delete;
+    RemoteBatch& operator=(const RemoteBatch&) = delete;
+
+    /**
+     * @brief Queue the fields of Layout at ptr for the next Fetch()
+     */
+    template <typename Layout>
+    RemoteView<Layout> Gather(RemotePtr<typename Layout::owner_type> ptr) {
+        Request request;
+        request.address = ptr.address + Layout::begin;
+        request.size = Layout::size;
+        request.base = Layout::begin;
+        request.storage = storage_.size();
+        request.valid = false;
+
+        storage_.resize(storage_.size() + Layout::size);
+        requests_.push_back(request);
+
+        // Null pointers are never read; the view simply reports !IsValid()
+        if (!ptr.IsNull()) {
+            pending_.push_back(requests_.size() - 1);
+        }
+
+        return RemoteView<Layout>(this, requests_.size() - 1, ptr);
+    }
+
+    /**
+     * @brief Read every request queued since the previous Fetch()
+     * @return true if all pending requests were read completely
+     */
+    bool Fetch() {
+        if (pending_.empty()) {
+            return true;
+        }
+
+        std::sort(pending_.begin(), pending_.end(), [this](size_t a, size_t b) {
+            return requests_[a].address < requests_[b].address;
+        });
+
+        bool allRead = true;
+        size_t first = 0;
+
+        while (first < pending_.size()) {
+            uintptr_t spanBegin = requests_[pending_[first]].address;
+            uintptr_t spanEnd = spanBegin + requests_[pending_[first]].size;
+            size_t last = first + 1;
+
+            // Extend the span while the next request overlaps or is close enough
+            while (last < pending_.size()) {
+                const Request& next = requests_[pending_[last]];
+                if (next.address > spanEnd + maxGap_) {
+                    break;
+                }
+                spanEnd = (std::max)(spanEnd, next.address + next.size);
+                last++;
+            }
+
+            if (!ReadSpan(first, last, spanBegin, spanEnd)) {
+                allRead = false;
+            }
+
+            first = last;
+        }
+
+        pending_.clear();
+        return allRead;
+    }
+
+    /**
+     * @brief Number of ReadProcessMemory calls issued so far
+     */
+    size_t ReadCount() const { return readCount_; }
+
+    /**
+     * @brief Drop all requests and views
+     *
+     * Views returned before Clear() must not be used afterwards.
+     */
+    void Clear() {
+        requests_.clear();
+        pending_.clear();
+        storage_.clear();
+    }
+
+private:
+    template <typename Layout>
+    friend class RemoteView;
+
+    struct Request {
+        uintptr_t address;
+        size_t size;
+        size_t base;     // Offset of the first fetched byte inside the struct
+        size_t storage;  // Offset of the snapshot inside storage_
+        bool valid;
+    };
+
+    bool ReadRaw(uintptr_t address, void* buffer, size_t size) {
+        SIZE_T bytesRead = 0;
+        readCount_++;
+        return ReadProcessMemory(hProcess_, reinterpret_cast<LPCVOID>(address), buffer, size, &bytesRead)
+            && bytesRead == size;
+    }
+
+    bool ReadSpan(size_t first, size_t last, uintptr_t spanBegin, uintptr_t spanEnd) {
+        span_.resize(spanEnd - spanBegin);
+
+        if (ReadRaw(spanBegin, span_.data(), span_.size())) {
+            for (size_t i = first; i < last; i++) {
+                Request& request = requests_[pending_[i]];
+                memcpy(&storage_[request.storage], &span_[request.address - spanBegin], request.size);
+                request.valid = true;
+            }
+            return true;
+        }
+
+        // The span may cross an unmapped page; fall back to reading each request alone
+        bool allRead = true;
+        for (size_t i = first; i < last; i++) {
+            Request& request = requests_[pending_[i]];
+            request.valid = ReadRaw(request.address, &storage_[request.storage], request.size);
+            allRead = allRead && request.valid;
+        }
+        return allRead;
+    }
+
+    HANDLE hProcess_;
+    SIZE_T maxGap_;
+    size_t readCount_ = 0;
+    std::vector<Request> requests_;
+    std::vector<size_t> pending_;
+    std::vector<BYTE> storage_;
+    std::vector<BYTE> span_;
+};
+
+template <typename Layout>
+bool RemoteView<Layout>::IsValid() const {
+    return batch_ && batch_->requests_[request_].valid;
+}
+
+template <typename Layout>
+template <typename Field>
+typename Field::value_type RemoteView<Layout>::Get() const {
+    static_assert(Layout::template Contains<Field>, "Field is not part of this view's layout");
+
+    typename Field::value_type value{};
+    if (IsValid()) {
+        const auto& request = batch_->requests_[request_];
+        memcpy(&value, &batch_->storage_[request.storage + Field::offset - request.base], sizeof(value));
+    }
+    return value;
+}
+
+/**
+ * @brief Outcome of WalkRemoteLists
+ */
+struct RemoteWalkResult {
+    size_t visited = 0;          // Nodes passed to the visitor
+    size_t fetches = 0;          // Fetch() calls, one per pointer depth
+    size_t reads = 0;            // ReadProcessMemory calls across all fetches
+    std::vector<bool> truncated; // Per list: stopped by an unreadable node or maxDepth
+
+    /**
+     * @brief Check whether every list was followed to its null terminator
+     */
+    bool Complete() const {
+        return std::find(truncated.begin(), truncated.end(), true) == truncated.end();
+    }
+};
+
+/**
+ * @brief Walk many remote linked lists in lockstep
+ *
+ * Every round gathers the current node of each list into one batch, so the
+ * number of Fetch() calls equals the length of the longest list. Nodes of
+ * different lists share a read only when they lie close together.
+ *
+ * @tparam Layout Fields to read from each node; must contain NextField
+ * @tparam NextField Field holding RemotePtr to the next node
+ * @param hProcess Handle with PROCESS_VM_READ access
+ * @param heads First node of each list
+ * @param visit Called as visit(listIndex, view) for every node read
+ * @param maxDepth Upper bound on nodes followed per list (guards against cycles)
+ * @param maxGap Largest hole between two nodes still read as one span; raise it
+ *               to trade larger reads for fewer ReadProcessMemory calls
+ * @return Counters plus a truncated flag for each list
+ */
+template <typename Layout, typename NextField, typename Visitor>
+RemoteWalkResult WalkRemoteLists(HANDLE hProcess,
+                                 const std::vector<RemotePtr<typename Layout::owner_type>>& heads,
+                                 Visitor visit,
+                                 size_t maxDepth = 4096,
+                                 SIZE_T maxGap = 256) {
+    static_assert(Layout::template Contains<NextField>, "Layout must contain the next-pointer field");
+
+    using Ptr = RemotePtr<typename Layout::owner_type>;
+    static_assert(std::is_same<typename NextField::value_type, Ptr>::value,
+                  "NextField must be a RemotePtr to the same struct");
+
+    std::vector<Ptr> current = heads;
+    RemoteWalkResult result;
+    result.truncated.assign(heads.size(), false);
+
+    for (size_t depth = 0; depth < maxDepth; depth++) {
+        RemoteBatch batch(hProcess, maxGap);
+        std::vector<RemoteView<Layout>> views(current.size());
+        bool anyLive = false;
+
+        for (size_t i = 0; i < current.size(); i++) {
+            if (!current[i].IsNull()) {
+                views[i] = batch.template Gather<Layout>(current[i]);
+                anyLive = true;
+            }
+        }
+
+        if (!anyLive) {
+            return result;
+        }
+
+        batch.Fetch();
+        result.fetches++;
+        result.reads += batch.ReadCount();
+
+        for (size_t i = 0; i < current.size(); i++) {
+            if (current[i].IsNull()) {
+                continue;
+            }
+            if (!views[i].IsValid()) {
+                result.truncated[i] = true;
+                current[i] = Ptr();
+                continue;
+            }
+            visit(i, views[i]);
+            result.visited++;
+            current[i] = views[i].template Get<NextField>();
+        }
+    }
+
+    // Lists still live after maxDepth rounds were cut short
+    for (size_t i = 0; i < current.size(); i++) {
+        if (!current[i].IsNull()) {
+            result.truncated[i] = true;
+        }
+    }
+
+    return result;
+}
+
+} // namespace ProcessUtils
+
+#endif // REMOTE_STRUCT_H
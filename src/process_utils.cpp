@@ -216,4 +216,35 @@ bool WriteProcessMemorySafe(HANDLE hProcess, LPVOID address, LPCVOID buffer, SIZ
     return success;
 }
 
+// Enumerate readable regions
+std::vector<MemoryRegion> GetReadableRegions(HANDLE hProcess) {
+    std::vector<MemoryRegion> regions;
+    MEMORY_BASIC_INFORMATION mbi;
+    ULONG_PTR address = 0;
+
+    while (VirtualQueryEx(hProcess, (LPCVOID)address, &mbi, sizeof(mbi)) == sizeof(mbi)) {
+        bool readable = mbi.State == MEM_COMMIT &&
+                        mbi.Protect != 0 &&
+                        !(mbi.Protect & PAGE_NOACCESS) &&
+                        !(mbi.Protect & PAGE_GUARD);
+
+        if (readable) {
+            MemoryRegion region = { (ULONG_PTR)mbi.BaseAddress, mbi.RegionSize, mbi.Protect, mbi.Type };
+            regions.push_back(region);
+        }
+
+        ULONG_PTR next = (ULONG_PTR)mbi.BaseAddress + mbi.RegionSize;
+        if (next <= address) {
+            break; // Wrapped around the top of the address space
+        }
+        address = next;
+    }
+
+    if (regions.empty()) {
+        PrintError("VirtualQueryEx");
+    }
+
+    return regions;
+}
+
 } // namespace ProcessUtils
@@ -0,0 +1,826 @@
+#include "process_utils.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <regex>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define STRING_SCANNER_SSE2 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace ProcessUtils;
+
+// Bytes each worker owns per unit of work
+const SIZE_T kChunkSize = 1024 * 1024;
+
+// Bytes read past the end of a chunk so runs crossing it are not cut short
+const SIZE_T kRunOverlap = 4096;
+
+// Bytes read before a chunk to tell whether its first run started earlier
+const SIZE_T kChunkPrefix = 2;
+
+const SIZE_T kPageSize = 4096;
+const size_t kBlockSize = 16;
+const size_t kNoRun = static_cast<size_t>(-1);
+const unsigned long kMaxThreads = 64;
+
+// Only the first kMaxRegexInput bytes of a string are passed to --regex
+const size_t kMaxRegexInput = 4096;
+
+// std::regex recurses per input character in some implementations, so
+// workers reserve more stack than the 1 MB default to match kMaxRegexInput
+const SIZE_T kWorkerStackSize = 8 * 1024 * 1024;
+
+struct ScanOptions {
+    size_t minLength = 4;
+    bool scanNarrow = true;
+    bool scanWide = true;
+    const std::regex* filter = nullptr;
+};
+
+struct Chunk {
+    ULONG_PTR start;
+    SIZE_T size;
+    size_t region;
+};
+
+struct ScanStats {
+    std::atomic<unsigned long long> bytesScanned{0};
+    std::atomic<unsigned long long> stringsFound{0};
+    std::atomic<unsigned long long> unreadablePages{0};
+    std::atomic<unsigned long long> regexSkipped{0};
+};
+
+void PrintUsage(const char* programName) {
+    std::cout << "\n=== String Scanner ===" << std::endl;
+    std::cout << "Educational tool for extracting strings from process memory\n" << std::endl;
+    std::cout << "Usage:" << std::endl;
+    std::cout << "  " << programName << " <process_name> <output_file> [options]" << std::endl;
+    std::cout << "\nOptions:" << std::endl;
+    std::cout << "  --min <n>        Minimum string length in characters (default 4)" << std::endl;
+    std::cout << "  --encoding <e>   ascii, utf16 or all (default all)" << std::endl;
+    std::cout << "  --regex <expr>   Only keep strings matching the regular expression (first 4 KB)" << std::endl;
+    std::cout << "  --threads <n>    Number of worker threads (default: CPU count, max 64)" << std::endl;
+    std::cout << "\nExamples:" << std::endl;
+    std::cout << "  " << programName << " notepad.exe strings.txt" << std::endl;
+    std::cout << "  " << programName << " worker.exe urls.txt --min 8 --regex \"https?://\"" << std::endl;
+    std::cout << "  " << programName << " worker.exe wide.txt --encoding utf16 --threads 4" << std::endl;
+    std::cout << "\nNotes:" << std::endl;
+    std::cout << "  - Requires Administrator privileges for most targets" << std::endl;
+    std::cout << "  - Output is tab separated: address, region, type, encoding, text" << std::endl;
+    std::cout << "  - Lines are written as chunks finish, not in address order" << std::endl;
+    std::cout << std::endl;
+}
+
+// Byte may belong to an ASCII/UTF-8 run (printable, tab or non-ASCII)
+inline bool IsNarrowText(const BYTE* p) {
+    return (p[0] >= 0x20 && p[0] < 0x7F) || p[0] == '\t' || p[0] >= 0x80;
+}
+
+// High byte of a UTF-16LE code unit in one of the ranges ClassifyWideUnit accepts
+inline bool IsWideHighByte(BYTE high) {
+    return (high >= 0x01 && high <= 0x06) || high == 0x0E || high == 0x20 ||
+           high == 0x30 || high == 0x31 || (high >= 0x4E && high <= 0x9F) ||
+           (high >= 0xAC && high <= 0xDF) || high == 0xFF;
+}
+
+// UTF-16LE code unit may belong to a wide run (coarse check on the high byte;
+// EmitWideRun validates each unit exactly)
+inline bool IsWideText(const BYTE* p) {
+    if (p[1] == 0) {
+        return (p[0] >= 0x20 && p[0] < 0x7F) || p[0] == '\t' || p[0] >= 0xA0;
+    }
+    return IsWideHighByte(p[1]);
+}
+
+// Bit i set when byte i of the 16-byte block passes IsNarrowText
+inline unsigned NarrowBlockMask(const BYTE* p) {
+#ifdef STRING_SCANNER_SSE2
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1F)),
+                                      _mm_cmplt_epi8(v, _mm_set1_epi8(0x7F)));
+    __m128i tab = _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'));
+    // Bytes >= 0x80 already carry their sign bit into the movemask
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(printable, tab), v)));
+#else
+    unsigned mask = 0;
+    for (size_t i = 0; i < kBlockSize; i++) {
+        if (IsNarrowText(p + i)) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+#ifdef STRING_SCANNER_SSE2
+// 0xFF in each lane whose unsigned byte lies in [low, high]
+inline __m128i ByteInRange(__m128i v, BYTE low, BYTE high) {
+    __m128i aboveLow = _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(static_cast<char>(low))), v);
+    __m128i belowHigh = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(static_cast<char>(high))), v);
+    return _mm_and_si128(aboveLow, belowHigh);
+}
+#endif
+
+// Bit 2k set when code unit k of the 16-byte block passes IsWideText
+inline unsigned WideBlockMask(const BYTE* p) {
+#ifdef STRING_SCANNER_SSE2
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    // Low byte test, used where the high byte is zero
+    __m128i latin = _mm_or_si128(_mm_or_si128(ByteInRange(v, 0x20, 0x7E), ByteInRange(v, 0xA0, 0xFF)),
+                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    unsigned lowOk = static_cast<unsigned>(_mm_movemask_epi8(latin));
+    unsigned zero = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())));
+
+    // High byte test, mirrors IsWideHighByte
+    __m128i high = _mm_or_si128(ByteInRange(v, 0x01, 0x06), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x0E)));
+    high = _mm_or_si128(high, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20)));
+    high = _mm_or_si128(high, ByteInRange(v, 0x30, 0x31));
+    high = _mm_or_si128(high, ByteInRange(v, 0x4E, 0x9F));
+    high = _mm_or_si128(high, ByteInRange(v, 0xAC, 0xDF));
+    high = _mm_or_si128(high, _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(0xFF))));
+    unsigned highOk = static_cast<unsigned>(_mm_movemask_epi8(high));
+
+    return ((lowOk & (zero >> 1)) | (highOk >> 1)) & 0x5555;
+#else
+    unsigned mask = 0;
+    for (size_t i = 0; i < kBlockSize; i += 2) {
+        if (IsWideText(p + i)) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+// Index of the lowest set bit (mask must be non-zero)
+inline size_t LowestSetBit(unsigned mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+
+/**
+ * Find maximal runs of text units in data[scanBegin, length) and call
+ * emit(begin, end) for each run starting inside [ownedBegin, ownedEnd).
+ * Each 16-byte block is classified at once; the scan then jumps straight to
+ * the next text/non-text transition, so non-text memory is skipped a block at
+ * a time. Only the last partial block is walked unit by unit.
+ */
+template <typename MaskFn, typename TextFn, typename EmitFn>
+void ScanRuns(const BYTE* data, size_t length, size_t scanBegin, size_t ownedBegin, size_t ownedEnd,
+              size_t unit, unsigned fullMask, MaskFn blockMask, TextFn isText, EmitFn emit) {
+    size_t runStart = kNoRun;
+    size_t i = scanBegin;
+
+    while (i + unit <= length) {
+        if (runStart == kNoRun && i >= ownedEnd) {
+            return;
+        }
+
+        size_t next;
+        if (i + kBlockSize <= length) {
+            unsigned mask = blockMask(data + i);
+            unsigned transitions = (runStart == kNoRun) ? mask : (~mask & fullMask);
+            if (transitions == 0) {
+                i += kBlockSize;
+                continue;
+            }
+            next = i + LowestSetBit(transitions);
+        } else if (isText(data + i) == (runStart == kNoRun)) {
+            next = i;
+        } else {
+            i += unit;
+            continue;
+        }
+
+        if (runStart == kNoRun) {
+            if (next >= ownedEnd) {
+                return;
+            }
+            runStart = next;
+        } else {
+            if (runStart >= ownedBegin) {
+                emit(runStart, next);
+            }
+            runStart = kNoRun;
+        }
+
+        i = next;
+    }
+
+    // Run reaches the end of the buffer (region end or overlap limit)
+    if (runStart != kNoRun && runStart >= ownedBegin && runStart < ownedEnd) {
+        emit(runStart, i);
+    }
+}
+
+// Length of the valid UTF-8 sequence at p, or 0 if invalid
+size_t Utf8SequenceLength(const BYTE* p, size_t available) {
+    BYTE lead = p[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+
+    size_t length;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+    } else {
+        return 0;
+    }
+
+    if (length > available) {
+        return 0;
+    }
+
+    for (size_t i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+    }
+
+    // Reject overlong encodings, surrogates and code points above U+10FFFF
+    if ((lead == 0xE0 && p[1] < 0xA0) || (lead == 0xED && p[1] > 0x9F) ||
+        (lead == 0xF0 && p[1] < 0x90) || (lead == 0xF4 && p[1] > 0x8F)) {
+        return 0;
+    }
+
+    return length;
+}
+
+const char* RegionTypeName(DWORD type) {
+    switch (type) {
+        case MEM_IMAGE:   return "image";
+        case MEM_MAPPED:  return "mapped";
+        case MEM_PRIVATE: return "private";
+        default:          return "unknown";
+    }
+}
+
+// Append one output line, applying the regex filter if one was given
+void AppendString(std::string& out, const ScanOptions& options, const MemoryRegion& region,
+                  ULONG_PTR address, const char* encoding, const std::string& text, ScanStats& stats) {
+    if (options.filter) {
+        size_t length = (text.size() < kMaxRegexInput) ? text.size() : kMaxRegexInput;
+        try {
+            if (!std::regex_search(text.begin(), text.begin() + length, *options.filter)) {
+                return;
+            }
+        } catch (const std::regex_error&) {
+            // error_complexity / error_stack: the pattern is too costly for this string
+            stats.regexSkipped++;
+            return;
+        }
+    }
+
+    char prefix[96];
+    snprintf(prefix, sizeof(prefix), "0x%016llX\t0x%016llX\t%s\t%s\t",
+             (unsigned long long)address, (unsigned long long)region.baseAddress,
+             RegionTypeName(region.type), encoding);
+    out += prefix;
+
+    for (char c : text) {
+        if (c == '\t') {
+            out += "\\t";
+        } else if (c == '\\') {
+            out += "\\\\";
+        } else {
+            out += c;
+        }
+    }
+    out += '\n';
+
+    stats.stringsFound++;
+}
+
+// Split a narrow run into valid UTF-8 segments and emit those long enough
+void EmitNarrowRun(const BYTE* data, size_t begin, size_t end, ULONG_PTR bufferAddress,
+                   const ScanOptions& options, const MemoryRegion& region, std::string& out, ScanStats& stats) {
+    size_t segmentStart = begin;
+    size_t characters = 0;
+    bool multibyte = false;
+
+    auto flush = [&](size_t segmentEnd) {
+        if (characters >= options.minLength) {
+            std::string text(reinterpret_cast<const char*>(data + segmentStart), segmentEnd - segmentStart);
+            AppendString(out, options, region, bufferAddress + segmentStart,
+                         multibyte ? "utf8" : "ascii", text, stats);
+        }
+    };
+
+    size_t i = begin;
+    while (i < end) {
+        size_t length = Utf8SequenceLength(data + i, end - i);
+        if (length == 0) {
+            flush(i);
+            i++;
+            segmentStart = i;
+            characters = 0;
+            multibyte = false;
+            continue;
+        }
+        characters++;
+        multibyte = multibyte || length > 1;
+        i += length;
+    }
+
+    flush(end);
+}
+
+// Script of a BMP code unit; runs are split where the script changes so that
+// binary data, which lands in many scripts at once, rarely forms long runs
+enum WideScript {
+    kWideInvalid,
+    kWideNeutral,   // ASCII, punctuation and symbols; joins any script
+    kWideLatin,
+    kWideGreek,
+    kWideCyrillic,
+    kWideArmenian,
+    kWideHebrew,
+    kWideArabic,
+    kWideThai,
+    kWideCjk,
+    kWideHangul
+};
+
+// Classify a printable BMP code unit; C0/C1 controls, surrogates and
+// unlisted blocks are invalid
+WideScript ClassifyWideUnit(unsigned unit) {
+    if (unit == '\t' || (unit >= 0x20 && unit <= 0x7E)) return kWideNeutral;
+    if (unit < 0xA0) return kWideInvalid;
+    if (unit < 0x370) return kWideLatin;
+    if (unit < 0x400) return kWideGreek;
+    if (unit < 0x530) return kWideCyrillic;
+    if (unit < 0x590) return kWideArmenian;
+    if (unit < 0x600) return kWideHebrew;
+    if (unit < 0x700) return kWideArabic;
+    if (unit >= 0x0E00 && unit < 0x0E80) return kWideThai;
+    if (unit >= 0x2000 && unit < 0x2100) return kWideNeutral;
+    if (unit >= 0x3130 && unit < 0x3190) return kWideHangul;
+    if (unit >= 0x3000 && unit < 0x3200) return kWideCjk;
+    if (unit >= 0x4E00 && unit < 0xA000) return kWideCjk;
+    if (unit >= 0xAC00 && unit < 0xD7A4) return kWideHangul;
+    if (unit >= 0xFF01 && unit < 0xFFA0) return kWideCjk;
+    if (unit >= 0xFFA0 && unit < 0xFFDD) return kWideHangul;
+    if (unit >= 0xFFE0 && unit < 0xFFEF) return kWideNeutral;
+    return kWideInvalid;
+}
+
+void AppendUtf8(std::string& text, unsigned codePoint) {
+    if (codePoint < 0x80) {
+        text += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        text += static_cast<char>(0xC0 | (codePoint >> 6));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        text += static_cast<char>(0xE0 | (codePoint >> 12));
+        text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        text += static_cast<char>(0xF0 | (codePoint >> 18));
+        text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+inline bool IsPrintableAscii(BYTE b) {
+    return b >= 0x20 && b < 0x7F;
+}
+
+// Split a wide run into valid single-script segments and emit them as UTF-8
+void EmitWideRun(const BYTE* data, size_t begin, size_t end, ULONG_PTR bufferAddress,
+                 const ScanOptions& options, const MemoryRegion& region, std::string& out, ScanStats& stats) {
+    if ((end - begin) / 2 < options.minLength) {
+        return;
+    }
+
+    size_t segmentStart = begin;
+    size_t characters = 0;
+    WideScript script = kWideNeutral;
+    size_t highUnits = 0;
+    size_t highUnitsNotAscii = 0;
+    std::string text;
+
+    auto flush = [&]() {
+        // Narrow ASCII text read as UTF-16 decodes to CJK: every unit with a
+        // non-zero high byte is two printable ASCII bytes, except at most one
+        // edge unit pairing the text with the byte before it
+        bool misreadNarrow = highUnits > 0 && highUnitsNotAscii <= 1 && highUnits > highUnitsNotAscii;
+        if (characters >= options.minLength && !misreadNarrow) {
+            AppendString(out, options, region, bufferAddress + segmentStart, "utf16le", text, stats);
+        }
+    };
+
+    auto restart = [&](size_t start) {
+        segmentStart = start;
+        characters = 0;
+        script = kWideNeutral;
+        highUnits = 0;
+        highUnitsNotAscii = 0;
+        text.clear();
+    };
+
+    size_t i = begin;
+    while (i + 2 <= end) {
+        unsigned unit = data[i] | (data[i + 1] << 8);
+        unsigned codePoint = unit;
+        size_t width = 2;
+        WideScript unitScript = ClassifyWideUnit(unit);
+
+        // A high surrogate followed by a low surrogate is one supplementary character
+        if (unit >= 0xD800 && unit <= 0xDBFF && i + 4 <= end) {
+            unsigned low = data[i + 2] | (data[i + 3] << 8);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                codePoint = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                width = 4;
+                unitScript = kWideNeutral;
+            }
+        }
+
+        if (unitScript == kWideInvalid) {
+            flush();
+            restart(i + 2);
+            i += 2;
+            continue;
+        }
+
+        if (unitScript != kWideNeutral) {
+            if (script != kWideNeutral && unitScript != script) {
+                flush();
+                restart(i);
+            }
+            script = unitScript;
+        }
+
+        if (data[i + 1] != 0) {
+            highUnits++;
+            if (!IsPrintableAscii(data[i]) || !IsPrintableAscii(data[i + 1])) {
+                highUnitsNotAscii++;
+            }
+        }
+        AppendUtf8(text, codePoint);
+        characters++;
+        i += width;
+    }
+
+    flush();
+}
+
+// Read [address, address + size), zero-filling pages that cannot be read.
+// Only failed pages inside [ownedStart, ownedEnd) are counted, so pages in a
+// neighbouring chunk's prefix or overlap are not reported twice.
+void ReadChunk(HANDLE hProcess, ULONG_PTR address, BYTE* buffer, SIZE_T size,
+               ULONG_PTR ownedStart, ULONG_PTR ownedEnd, ScanStats& stats) {
+    SIZE_T bytesRead = 0;
+    if (ReadProcessMemory(hProcess, (LPCVOID)address, buffer, size, &bytesRead) && bytesRead == size) {
+        return;
+    }
+
+    // Pages may have been decommitted or reprotected since enumeration
+    SIZE_T offset = 0;
+    while (offset < size) {
+        ULONG_PTR current = address + offset;
+        SIZE_T pageRemaining = kPageSize - (current % kPageSize);
+        SIZE_T length = (pageRemaining < size - offset) ? pageRemaining : size - offset;
+
+        if (!ReadProcessMemory(hProcess, (LPCVOID)current, buffer + offset, length, &bytesRead) ||
+            bytesRead != length) {
+            memset(buffer + offset, 0, length);
+            if (current >= ownedStart && current < ownedEnd) {
+                stats.unreadablePages++;
+            }
+        }
+
+        offset += length;
+    }
+}
+
+void ScanChunk(HANDLE hProcess, const Chunk& chunk, const MemoryRegion& region, const ScanOptions& options,
+               std::vector<BYTE>& buffer, std::string& out, ScanStats& stats) {
+    ULONG_PTR regionEnd = region.baseAddress + region.size;
+    SIZE_T prefix = (chunk.start > region.baseAddress) ? kChunkPrefix : 0;
+    ULONG_PTR readStart = chunk.start - prefix;
+    ULONG_PTR readEnd = chunk.start + chunk.size + kRunOverlap;
+    if (readEnd > regionEnd) {
+        readEnd = regionEnd;
+    }
+
+    SIZE_T readSize = readEnd - readStart;
+    buffer.resize(readSize);
+    ReadChunk(hProcess, readStart, buffer.data(), readSize, chunk.start, chunk.start + chunk.size, stats);
+
+    const BYTE* data = buffer.data();
+    size_t ownedBegin = prefix;
+    size_t ownedEnd = prefix + chunk.size;
+
+    if (options.scanNarrow) {
+        ScanRuns(data, readSize, prefix ? prefix - 1 : 0, ownedBegin, ownedEnd, 1, 0xFFFF,
+                 NarrowBlockMask, IsNarrowText,
+                 [&](size_t begin, size_t end) {
+                     EmitNarrowRun(data, begin, end, readStart, options, region, out, stats);
+                 });
+    }
+
+    if (options.scanWide) {
+        // Chunk starts are even, so offset 0 keeps code units 2-byte aligned
+        ScanRuns(data, readSize, 0, ownedBegin, ownedEnd, 2, 0x5555,
+                 WideBlockMask, IsWideText,
+                 [&](size_t begin, size_t end) {
+                     EmitWideRun(data, begin, end, readStart, options, region, out, stats);
+                 });
+    }
+
+    stats.bytesScanned += chunk.size;
+}
+
+// Parse a positive decimal number; rejects empty input, signs and trailing text
+bool ParseCount(const char* text, unsigned long& value) {
+    if (text[0] < '0' || text[0] > '9') {
+        return false;
+    }
+
+    char* end = nullptr;
+    value = std::strtoul(text, &end, 10);
+    return *end == '\0' && value > 0;
+}
+
+DWORD WINAPI WorkerThreadProc(LPVOID param) {
+    (*static_cast<std::function<void()>*>(param))();
+    return 0;
+}
+
+std::vector<Chunk> SplitIntoChunks(const std::vector<MemoryRegion>& regions) {
+    std::vector<Chunk> chunks;
+
+    for (size_t i = 0; i < regions.size(); i++) {
+        for (SIZE_T offset = 0; offset < regions[i].size; offset += kChunkSize) {
+            SIZE_T remaining = regions[i].size - offset;
+            Chunk chunk = { regions[i].baseAddress + offset, remaining < kChunkSize ? remaining : kChunkSize, i };
+            chunks.push_back(chunk);
+        }
+    }
+
+    return chunks;
+}
+
+int main(int argc, char* argv[]) {
+    EnableConsoleColors(true);
+
+    std::cout << "\n";
+    PrintInfo("String Scanner v1.0");
+    PrintInfo("Educational Memory Analysis Tool");
+    std::cout << "\n";
+
+    // Check arguments
+    if (argc < 3) {
+        PrintErrorMsg("Invalid number of arguments");
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    const char* processName = argv[1];
+    const char* outputPath = argv[2];
+    ScanOptions options;
+    std::string encoding = "all";
+    std::string pattern;
+    unsigned long threadCount = std::thread::hardware_concurrency();
+
+    for (int i = 3; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg != "--min" && arg != "--encoding" && arg != "--regex" && arg != "--threads") {
+            PrintErrorMsg("Unknown option: " + arg);
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        if (i + 1 >= argc) {
+            PrintErrorMsg("Missing value for option: " + arg);
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--min" || arg == "--threads") {
+            unsigned long number = 0;
+            if (!ParseCount(value, number)) {
+                PrintErrorMsg("Option " + arg + " needs a positive number, got: " + value);
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            if (arg == "--min") {
+                options.minLength = number;
+            } else {
+                threadCount = number;
+            }
+        } else if (arg == "--encoding") {
+            encoding = value;
+        } else {
+            pattern = value;
+        }
+    }
+
+    if (encoding == "ascii") {
+        options.scanWide = false;
+    } else if (encoding == "utf16") {
+        options.scanNarrow = false;
+    } else if (encoding != "all") {
+        PrintErrorMsg("Unknown encoding: " + encoding);
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    if (threadCount > kMaxThreads) {
+        std::stringstream warning;
+        warning << "Thread count limited to " << kMaxThreads;
+        PrintWarning(warning.str());
+        threadCount = kMaxThreads;
+    }
+
+    std::regex filter;
+    if (!pattern.empty()) {
+        try {
+            filter = std::regex(pattern, std::regex::ECMAScript | std::regex::optimize);
+        } catch (const std::regex_error& e) {
+            PrintErrorMsg(std::string("Invalid regular expression: ") + e.what());
+            return 1;
+        }
+        options.filter = &filter;
+    }
+
+    PrintInfo(std::string("Target Process: ") + processName);
+    PrintInfo(std::string("Output File: ") + outputPath);
+
+    std::stringstream ss;
+    ss << "Minimum Length: " << options.minLength << " | Encoding: " << encoding << " | Threads: " << threadCount;
+    PrintInfo(ss.str());
+    if (options.filter) {
+        PrintInfo("Regex Filter: " + pattern);
+    }
+    std::cout << "\n";
+
+    // Step 1: Find process
+    PrintInfo("Searching for process...");
+    DWORD procId = GetProcessIdByName(processName);
+    if (procId == 0) {
+        PrintErrorMsg("Process not found. Is it running?");
+        return 2;
+    }
+
+    ss.str("");
+    ss << "Process found - PID: " << procId;
+    PrintSuccess(ss.str());
+
+    // Step 2: Open process
+    PrintInfo("Opening process...");
+    HANDLE hProcess = OpenProcess(PROCESS_VM_READ | PROCESS_QUERY_INFORMATION, FALSE, procId);
+    if (!hProcess) {
+        PrintErrorMsg("Failed to open process");
+        PrintWarning("Try running as Administrator!");
+        return 3;
+    }
+
+    PrintSuccess("Process opened successfully");
+
+    // Step 3: Enumerate readable memory
+    PrintInfo("Enumerating readable memory regions...");
+    std::vector<MemoryRegion> regions = GetReadableRegions(hProcess);
+    if (regions.empty()) {
+        PrintErrorMsg("No readable memory regions found");
+        CloseHandle(hProcess);
+        return 4;
+    }
+
+    std::vector<Chunk> chunks = SplitIntoChunks(regions);
+    unsigned long long totalBytes = 0;
+    for (const MemoryRegion& region : regions) {
+        totalBytes += region.size;
+    }
+
+    ss.str("");
+    ss << "Found " << regions.size() << " regions (" << (totalBytes / (1024 * 1024)) << " MB)";
+    PrintSuccess(ss.str());
+
+    // Step 4: Open output file
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        PrintErrorMsg(std::string("Failed to open output file: ") + outputPath);
+        CloseHandle(hProcess);
+        return 5;
+    }
+
+    // Step 5: Scan in parallel
+    PrintInfo("Scanning memory for strings...");
+    ScanStats stats;
+    std::atomic<size_t> nextChunk{0};
+    std::mutex outputMutex;
+    std::atomic<bool> writeFailed{false};
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::function<void()> worker = [&]() {
+        std::vector<BYTE> buffer;
+        std::string out;
+
+        for (size_t index = nextChunk++; index < chunks.size() && !writeFailed; index = nextChunk++) {
+            const Chunk& chunk = chunks[index];
+            ScanChunk(hProcess, chunk, regions[chunk.region], options, buffer, out, stats);
+
+            // Stream results as soon as each chunk is done
+            if (!out.empty()) {
+                std::lock_guard<std::mutex> lock(outputMutex);
+                output.write(out.data(), static_cast<std::streamsize>(out.size()));
+                out.clear();
+                if (!output) {
+                    writeFailed = true;
+                }
+            }
+        }
+    };
+
+    std::vector<HANDLE> workers;
+    for (unsigned long i = 0; i < threadCount; i++) {
+        HANDLE hThread = CreateThread(nullptr, kWorkerStackSize, WorkerThreadProc, &worker,
+                                      STACK_SIZE_PARAM_IS_A_RESERVATION, nullptr);
+        if (!hThread) {
+            PrintError("CreateThread");
+            break;
+        }
+        workers.push_back(hThread);
+    }
+
+    if (workers.empty()) {
+        PrintWarning("Scanning on the main thread");
+        worker();
+    }
+
+    for (HANDLE hThread : workers) {
+        WaitForSingleObject(hThread, INFINITE);
+        CloseHandle(hThread);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    output.close();
+    CloseHandle(hProcess);
+
+    // A full disk or lost share shows up as a failed write or close
+    if (writeFailed || output.fail()) {
+        PrintErrorMsg(std::string("Failed to write output file: ") + outputPath);
+        PrintWarning("The output is incomplete; check free disk space and try again");
+        return 6;
+    }
+
+    ss.str("");
+    ss << "Scanned " << (stats.bytesScanned / (1024 * 1024)) << " MB in " << std::fixed << std::setprecision(2)
+       << seconds << "s (" << (seconds > 0 ? stats.bytesScanned / (1024.0 * 1024.0) / seconds : 0.0) << " MB/s)";
+    PrintSuccess(ss.str());
+
+    ss.str("");
+    ss << "Strings written: " << stats.stringsFound;
+    PrintSuccess(ss.str());
+
+    if (stats.regexSkipped > 0) {
+        ss.str("");
+        ss << stats.regexSkipped << " strings were skipped because the regex was too complex to match them";
+        PrintWarning(ss.str());
+    }
+
+    if (stats.unreadablePages > 0) {
+        ss.str("");
+        ss << stats.unreadablePages << " pages became unreadable during the scan and were skipped";
+        PrintWarning(ss.str());
+    }
+
+    std::cout << "\n";
+    PrintSuccess("Operation completed successfully!");
+    std::cout << "\n";
+
+    return 0;
+}